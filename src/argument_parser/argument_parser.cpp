@@ -67,3 +67,43 @@ void ArgumentParser::parseArguments(int argc, char *argv[], std::string &inputNa
         }
     }
 }
+
+bool ArgumentParser::isPipelineParameter(const std::string &arg) 
+{
+    size_t equals = arg.find('=');
+    if (equals == std::string::npos || equals == 0) 
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < equals; i++) 
+    {
+        if (!std::isupper(static_cast<unsigned char>(arg[i])) && !std::isdigit(static_cast<unsigned char>(arg[i])) && arg[i] != '_') 
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ArgumentParser::parseArguments(int argc, char *argv[], std::string &inputName, int &cameraNumber, PipelineParameters &parameters) 
+{
+    // Separate the template parameters from the positional arguments
+    std::vector<char *> positional;
+    for (int i = 0; i < argc; i++) 
+    {
+        std::string arg = argv[i];
+        if (i > 0 && isPipelineParameter(arg)) 
+        {
+            size_t equals = arg.find('=');
+            parameters[arg.substr(0, equals)] = arg.substr(equals + 1);
+            spdlog::info("Pipeline parameter {} = {}", arg.substr(0, equals), arg.substr(equals + 1));
+        } 
+        else 
+        {
+            positional.push_back(argv[i]);
+        }
+    }
+
+    parseArguments(static_cast<int>(positional.size()), positional.data(), inputName, cameraNumber);
+}
@@ -5,6 +5,10 @@
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 #include <cstdlib>
+#include <vector>
+#include <cctype>
+
+#include "../pipeline_template/pipeline_template.h"
 
 /**
  * @class ArgumentParser
@@ -30,6 +34,30 @@ public:
      * @throws std::out_of_range if the camera number is not within the valid range (0 to 4).
      */
     static void parseArguments(int argc, char *argv[], std::string &inputName, int &cameraNumber);
+
+    /**
+     * @brief Parses command-line arguments that may also contain pipeline template parameters.
+     *
+     * Arguments of the form NAME=value, where NAME consists of upper case letters, digits and underscores,
+     * are collected as template parameters (e.g. MODE=11 CAPS=video/x-raw,format=BGR,width=1280,height=720).
+     * The remaining arguments are validated as by parseArguments(int, char*[], std::string&, int&).
+     *
+     * @param argc The number of command-line arguments.
+     * @param argv The array of command-line argument strings.
+     * @param inputName Reference to a string where the parsed input file name will be stored.
+     * @param cameraNumber Reference to an integer where the parsed camera number will be stored.
+     * @param parameters Reference to the map receiving the pipeline template parameters.
+     * @throws std::invalid_argument if the remaining arguments are invalid.
+     * @throws std::out_of_range if the camera number is not within the valid range (0 to 4).
+     */
+    static void parseArguments(int argc, char *argv[], std::string &inputName, int &cameraNumber, PipelineParameters &parameters);
+
+    /**
+     * @brief Checks if an argument is a pipeline template parameter of the form NAME=value.
+     * @param arg The argument to be checked.
+     * @return true if the argument names a template parameter, false otherwise.
+     */
+    static bool isPipelineParameter(const std::string &arg);
 };
 
 #endif // ARGUMENTPARSER_H
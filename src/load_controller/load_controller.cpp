@@ -0,0 +1,232 @@
+#include "load_controller.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+LoadController::LoadController(const LoadControllerConfig& config)
+    : config_(config)
+{
+    if (config_.targetFps <= 0.0 || config_.latencyBudgetMs <= 0.0)
+    {
+        throw std::invalid_argument("Target fps and latency budget must be positive.");
+    }
+    if (config_.scales.empty() || config_.scales.front() != 1.0)
+    {
+        throw std::invalid_argument("Load controller scales must start at 1.0.");
+    }
+    for (size_t i = 0; i < config_.scales.size(); i++)
+    {
+        if (config_.scales[i] <= 0.0 || config_.scales[i] > 1.0)
+        {
+            throw std::invalid_argument("Load controller scales must be in (0, 1].");
+        }
+        if (i > 0 && config_.scales[i] > config_.scales[i - 1])
+        {
+            throw std::invalid_argument("Load controller scales must not increase.");
+        }
+    }
+    if (config_.maxFrameStride < 1)
+    {
+        throw std::invalid_argument("Maximum frame stride must be at least 1.");
+    }
+    if (config_.smoothing <= 0.0 || config_.smoothing > 1.0)
+    {
+        throw std::invalid_argument("Load controller smoothing must be in (0, 1].");
+    }
+    if (config_.degradeAfterFrames < 1 || config_.recoverAfterFrames < 1)
+    {
+        throw std::invalid_argument("Degrade and recover frame counts must be at least 1.");
+    }
+    if (config_.waitKeyMs < 1 || config_.waitKeyMs >= 1000.0 / config_.targetFps || config_.waitKeyMs >= config_.latencyBudgetMs)
+    {
+        throw std::invalid_argument("Wait time must be at least 1 ms and shorter than the frame period and the latency budget.");
+    }
+    if (config_.sinkMaxBuffers < 0)
+    {
+        throw std::invalid_argument("Sink max-buffers must not be negative.");
+    }
+
+    levelCount_ = static_cast<int>(config_.scales.size()) + config_.maxFrameStride - 1;
+}
+
+bool LoadController::shouldProcess()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    bool process = frameIndex_ % static_cast<uint64_t>(strideAt(level_)) == 0;
+    frameIndex_++;
+    if (!process)
+    {
+        skippedFrames_++;
+    }
+    return process;
+}
+
+FrameTransform LoadController::prepareFrame(const cv::Mat& frame, cv::Mat& output) const
+{
+    int level;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        level = level_;
+    }
+
+    FrameTransform transform;
+    transform.roi = cv::Rect(0, 0, frame.cols, frame.rows);
+    transform.scale = scaleAt(level);
+
+    cv::Rect roi = config_.roi & transform.roi;
+    if (level > 0 && roi.area() > 0)
+    {
+        transform.roi = roi;
+    }
+
+    cv::Mat source = frame(transform.roi);
+    if (transform.scale < 1.0)
+    {
+        cv::resize(source, output, cv::Size(), transform.scale, transform.scale, cv::INTER_AREA);
+    }
+    else
+    {
+        output = source;
+    }
+    return transform;
+}
+
+void LoadController::recordOverheadTime(double overheadMs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    averageOverheadMs_ = hasOverhead_ ? config_.smoothing * overheadMs + (1.0 - config_.smoothing) * averageOverheadMs_ : overheadMs;
+    hasOverhead_ = true;
+}
+
+void LoadController::recordProcessingTime(double processingMs, const cv::Size& frameSize)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // How much of the frame the ROI keeps, so cost predictions account for the crop
+    cv::Rect roi = config_.roi & cv::Rect(0, 0, frameSize.width, frameSize.height);
+    if (roi.area() > 0)
+    {
+        roiFraction_ = static_cast<double>(roi.area()) / static_cast<double>(frameSize.area());
+    }
+
+    processedFrames_++;
+    averageMs_ = hasAverage_ ? config_.smoothing * processingMs + (1.0 - config_.smoothing) * averageMs_ : processingMs;
+    hasAverage_ = true;
+
+    // Degrade when the averaged cost keeps exceeding what the current level can afford
+    if (averageMs_ > budgetAt(level_))
+    {
+        underThresholdFrames_ = 0;
+        if (++overBudgetFrames_ >= config_.degradeAfterFrames && level_ + 1 < levelCount_)
+        {
+            changeLevel(level_ + 1);
+        }
+        return;
+    }
+    overBudgetFrames_ = 0;
+
+    // Recover when the lighter level would still leave headroom, so the level does not oscillate
+    if (level_ > 0 && predictCost(level_, level_ - 1, averageMs_) < config_.recoverThreshold * budgetAt(level_ - 1))
+    {
+        if (++underThresholdFrames_ >= config_.recoverAfterFrames)
+        {
+            changeLevel(level_ - 1);
+        }
+    }
+    else
+    {
+        underThresholdFrames_ = 0;
+    }
+}
+
+int LoadController::level() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return level_;
+}
+
+LoadControllerMetrics LoadController::metrics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    LoadControllerMetrics metrics;
+    metrics.level = level_;
+    metrics.scale = scaleAt(level_);
+    metrics.frameStride = strideAt(level_);
+    metrics.averageProcessingMs = averageMs_;
+    metrics.averageOverheadMs = averageOverheadMs_;
+    metrics.processedFrames = processedFrames_;
+    metrics.skippedFrames = skippedFrames_;
+    metrics.degradations = degradations_;
+    metrics.recoveries = recoveries_;
+    metrics.recentDecisions.assign(recentDecisions_.begin(), recentDecisions_.end());
+    return metrics;
+}
+
+double LoadController::scaleAt(int level) const
+{
+    size_t index = std::min(static_cast<size_t>(level), config_.scales.size() - 1);
+    return config_.scales[index];
+}
+
+int LoadController::strideAt(int level) const
+{
+    int scaleLevels = static_cast<int>(config_.scales.size());
+    return level < scaleLevels ? 1 : level - scaleLevels + 2;
+}
+
+double LoadController::pixelFractionAt(int level) const
+{
+    // Degraded levels process the ROI only, downscaled
+    double scale = scaleAt(level);
+    return scale * scale * (level > 0 ? roiFraction_ : 1.0);
+}
+
+double LoadController::budgetAt(int level) const
+{
+    // The loop is synchronous: while a frame is processed the source keeps at most sinkMaxBuffers frames
+    // (plus the one being delivered) for the following passes, so skipping frames only credits that many periods.
+    // Every pass also pays the overhead outside the processing step, which degradation does not reduce.
+    int stride = strideAt(level);
+    int credit = config_.sinkMaxBuffers == 0 ? stride : std::min(stride, config_.sinkMaxBuffers + 1);
+    double periodMs = 1000.0 / config_.targetFps;
+    double budgetMs = std::min(config_.latencyBudgetMs - averageOverheadMs_, credit * (periodMs - averageOverheadMs_));
+    return std::max(0.0, budgetMs);
+}
+
+double LoadController::predictCost(int fromLevel, int toLevel, double costMs) const
+{
+    // Processing cost is assumed to grow with the number of pixels
+    return costMs * pixelFractionAt(toLevel) / pixelFractionAt(fromLevel);
+}
+
+void LoadController::changeLevel(int toLevel)
+{
+    LoadDecision decision{frameIndex_, level_, toLevel, averageMs_, budgetAt(level_)};
+
+    if (toLevel > level_)
+    {
+        degradations_++;
+        spdlog::warn("Load controller: degrading to level {} (scale {}, every {} frame(s)), average {:.1f} ms over budget {:.1f} ms",
+                     toLevel, scaleAt(toLevel), strideAt(toLevel), decision.averageMs, decision.budgetMs);
+    }
+    else
+    {
+        recoveries_++;
+        spdlog::info("Load controller: recovering to level {} (scale {}, every {} frame(s)), average {:.1f} ms",
+                     toLevel, scaleAt(toLevel), strideAt(toLevel), decision.averageMs);
+    }
+
+    averageMs_ = predictCost(level_, toLevel, averageMs_);
+    level_ = toLevel;
+    overBudgetFrames_ = 0;
+    underThresholdFrames_ = 0;
+
+    recentDecisions_.push_back(decision);
+    if (recentDecisions_.size() > MAX_RECENT_DECISIONS)
+    {
+        recentDecisions_.pop_front();
+    }
+}
@@ -0,0 +1,163 @@
+#ifndef LOADCONTROLLER_H
+#define LOADCONTROLLER_H
+
+#include <opencv2/opencv.hpp>
+#include <spdlog/spdlog.h>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Tuning parameters of the LoadController.
+ */
+struct LoadControllerConfig
+{
+    double targetFps = 30.0;                   ///< Frame rate the processing loop has to keep up with.
+    double latencyBudgetMs = 100.0;            ///< Upper bound on the processing time of a single frame.
+    std::vector<double> scales = {1.0, 0.75, 0.5}; ///< Resolution scales tried, in order, before skipping frames.
+    int maxFrameStride = 4;                    ///< Largest N when only every Nth frame is processed.
+    cv::Rect roi;                              ///< Optional region kept at degraded levels; empty means the full frame.
+    double smoothing = 0.2;                    ///< Weight of the newest sample in the processing time average.
+    double recoverThreshold = 0.7;             ///< Fraction of the budget the predicted cost must stay under to recover.
+    int degradeAfterFrames = 3;                ///< Consecutive over-budget frames before degrading.
+    int recoverAfterFrames = 30;               ///< Consecutive under-threshold frames before recovering.
+    int waitKeyMs = 1;                         ///< Delay passed to cv::waitKey on every frame.
+    int sinkMaxBuffers = 1;                    ///< appsink max-buffers of the source (0 = unlimited); bounds what skipping frames can save.
+};
+
+/**
+ * @brief Describes how a prepared image relates to the captured frame.
+ *
+ * A point p in the prepared image lies at roi.tl() + p / scale in the captured frame.
+ */
+struct FrameTransform
+{
+    cv::Rect roi;       ///< Region of the captured frame the image was taken from.
+    double scale = 1.0; ///< Resize factor applied to that region.
+};
+
+/**
+ * @brief A single change of degradation level taken by the LoadController.
+ */
+struct LoadDecision
+{
+    uint64_t frameIndex;
+    int fromLevel;
+    int toLevel;
+    double averageMs;
+    double budgetMs;
+};
+
+/**
+ * @brief A snapshot of the LoadController state.
+ */
+struct LoadControllerMetrics
+{
+    int level = 0;
+    double scale = 1.0;
+    int frameStride = 1;
+    double averageProcessingMs = 0.0;
+    double averageOverheadMs = 0.0;            ///< Per-frame time spent outside the processing step.
+    uint64_t processedFrames = 0;
+    uint64_t skippedFrames = 0;
+    uint64_t degradations = 0;
+    uint64_t recoveries = 0;
+    std::vector<LoadDecision> recentDecisions;
+};
+
+/**
+ * @class LoadController
+ * @brief Feedback controller that degrades frame processing when the loop cannot keep up with a target frame rate.
+ *
+ * Level 0 processes every frame at full resolution. Higher levels first process a smaller
+ * image (resized, and cropped to the configured ROI), then only every Nth frame. The budget
+ * of a processed frame is what remains of the frame period after the per-frame overhead
+ * (reading, displaying, waiting), times the number of frames the source can buffer while
+ * it is processed. The level is raised when the averaged processing time exceeds that budget
+ * and lowered again once the predicted cost of the lighter level fits comfortably. Only the
+ * processing step is shed, so if the overhead alone exceeds the frame period the target rate
+ * cannot be reached at any level.
+ */
+class LoadController
+{
+public:
+    /**
+     * @brief Constructor for LoadController class.
+     * @param config The controller tuning parameters.
+     * @throws std::invalid_argument if the configuration is inconsistent.
+     */
+    explicit LoadController(const LoadControllerConfig& config = LoadControllerConfig());
+
+    /**
+     * @brief Decides whether the next captured frame should be processed.
+     * @return true if the frame should be processed, false if it should be skipped.
+     */
+    bool shouldProcess();
+
+    /**
+     * @brief Produces the image to process for the current degradation level.
+     * @param frame The captured frame.
+     * @param output The image to process; shares data with the frame at level 0.
+     * @return The region and scale mapping the output back onto the captured frame.
+     */
+    FrameTransform prepareFrame(const cv::Mat& frame, cv::Mat& output) const;
+
+    /**
+     * @brief Feeds the processing time of a frame back into the controller.
+     * @param processingMs The time spent processing the frame, in milliseconds.
+     * @param frameSize The size of the captured frame, used to weigh the ROI in cost predictions.
+     */
+    void recordProcessingTime(double processingMs, const cv::Size& frameSize);
+
+    /**
+     * @brief Feeds the time a loop pass spent outside the processing step back into the controller.
+     * @param overheadMs The time spent retrieving, publishing, displaying and waiting, in milliseconds.
+     */
+    void recordOverheadTime(double overheadMs);
+
+    /**
+     * @brief Returns the current degradation level, 0 meaning no degradation.
+     */
+    int level() const;
+
+    /**
+     * @brief Returns the delay the processing loop waits in cv::waitKey on every frame.
+     */
+    int waitKeyMs() const { return config_.waitKeyMs; }
+
+    /**
+     * @brief Returns a snapshot of the controller state and its recent decisions.
+     */
+    LoadControllerMetrics metrics() const;
+
+private:
+    double scaleAt(int level) const;
+    int strideAt(int level) const;
+    double pixelFractionAt(int level) const;
+    double budgetAt(int level) const;
+    double predictCost(int fromLevel, int toLevel, double costMs) const;
+    void changeLevel(int toLevel);
+
+    static constexpr size_t MAX_RECENT_DECISIONS = 32;
+
+    LoadControllerConfig config_;
+    int levelCount_;
+    int level_ = 0;
+    double roiFraction_ = 1.0;
+    double averageMs_ = 0.0;
+    bool hasAverage_ = false;
+    double averageOverheadMs_ = 0.0;
+    bool hasOverhead_ = false;
+    int overBudgetFrames_ = 0;
+    int underThresholdFrames_ = 0;
+    uint64_t frameIndex_ = 0;
+    uint64_t processedFrames_ = 0;
+    uint64_t skippedFrames_ = 0;
+    uint64_t degradations_ = 0;
+    uint64_t recoveries_ = 0;
+    std::deque<LoadDecision> recentDecisions_;
+    mutable std::mutex mutex_;
+};
+
+#endif // LOADCONTROLLER_H
@@ -26,16 +26,21 @@ int main(int argc, char *argv[])
 
         std::string inputName;
         int cameraNumber;
+        PipelineParameters pipelineParameters;
 
         // Validate and parse command-line arguments.
-        ArgumentParser::parseArguments(argc, argv, inputName, cameraNumber);
+        ArgumentParser::parseArguments(argc, argv, inputName, cameraNumber, pipelineParameters);
 
         cv::VideoWriter writer;
         cv::VideoCapture videoCapture;
+        cv::Mat firstFrame;
         cv::utils::logging::setLogLevel(cv::utils::logging::LOG_LEVEL_ERROR);
 
+        // Load and validate all pipeline templates once, before any source is opened.
+        PipelineCreator::loadTemplates();
+
         // Check if the input source is a video file or a camera.
-        bool isFindSourceImage = PipelineCreator::findSourceImage(inputName, videoCapture, cameraNumber);
+        bool isFindSourceImage = PipelineCreator::findSourceImage(inputName, videoCapture, cameraNumber, firstFrame, pipelineParameters);
 
         if (!isFindSourceImage)
         {
@@ -60,7 +65,23 @@ int main(int argc, char *argv[])
             }
         }
 
-        VideoProcessor::processVideo(videoCapture, writer, stopProgram);
+        // Budget the load controller by the rate the source actually delivers, and by how many frames its appsink keeps
+        LoadControllerConfig loadConfig;
+        double sourceFps = videoCapture.get(cv::CAP_PROP_FPS);
+        if (sourceFps > 0.0) 
+        {
+            loadConfig.targetFps = sourceFps;
+        }
+        if (pipelineParameters.count("MAX_BUFFERS")) 
+        {
+            loadConfig.sinkMaxBuffers = std::stoi(pipelineParameters["MAX_BUFFERS"]);
+        }
+        LoadController loadController(loadConfig);
+        VideoProcessor::processVideo(videoCapture, writer, stopProgram, loadController, firstFrame);
+
+        LoadControllerMetrics loadMetrics = loadController.metrics();
+        spdlog::info("Load controller: level {}, processed {} frames, skipped {} frames, {} degradations, {} recoveries, overhead {:.1f} ms per frame",
+                     loadMetrics.level, loadMetrics.processedFrames, loadMetrics.skippedFrames, loadMetrics.degradations, loadMetrics.recoveries, loadMetrics.averageOverheadMs);
 
         writer.release();
         writer.~VideoWriter();
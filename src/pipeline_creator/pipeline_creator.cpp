@@ -1,55 +1,30 @@
 #include "pipeline_creator.h"
 
-std::string PipelineCreator::loadDefaultPipeline() 
+void PipelineCreator::loadTemplates()
 {
-    std::ifstream file(std::string(DEFAULT_PIPELINE));
-    if (!file.is_open()) 
-    {
-        spdlog::error("Error: Unable to open configuration file: {}", std::string(DEFAULT_PIPELINE));
-        exit(EXIT_FAILURE);
-    }
-
-    std::string pipeline;
-    std::getline(file, pipeline);
-    file.close();
-    return pipeline;
+    PipelineTemplateCache::loadAll({DEFAULT_PIPELINE, DECKLINK_PIPELINE, FILE_PIPELINE});
 }
 
-std::string PipelineCreator::CreateDecklinkPipeline(int cameraNumber) 
+std::string PipelineCreator::loadDefaultPipeline(const PipelineParameters& parameters) 
 {
-    // Read decklink pipeline configuration from file
-    std::ifstream config_file(std::string(DECKLINK_PIPELINE));
-    if (!config_file.is_open()) 
-    {
-        spdlog::error(" Could not open pipeline configuration file.");
-        return "";
-    }
-
-    std::stringstream buffer;
-    buffer << config_file.rdbuf();
-    std::string pipeline_template = buffer.str();
-
-    // Update camera number in the pipeline template
-    size_t pos = pipeline_template.find("$CAMERA_NUMBER$");
-    if (pos != std::string::npos) 
-    {
-        pipeline_template.replace(pos, std::string("$CAMERA_NUMBER$").length(), std::to_string(cameraNumber));
-    } 
-    else 
-    {
-        spdlog::error("Camera number placeholder not found in pipeline template.");
-        return "";
-    }
+    return PipelineTemplateCache::render(DEFAULT_PIPELINE, parameters);
+}
 
-    return pipeline_template;
+std::string PipelineCreator::CreateDecklinkPipeline(int cameraNumber, const PipelineParameters& parameters)
+{
+    PipelineParameters values = parameters;
+    values["CAMERA_NUMBER"] = std::to_string(cameraNumber);
+    return PipelineTemplateCache::render(DECKLINK_PIPELINE, values);
 }
 
-bool PipelineCreator::findSourceImage(const std::string& inputName, cv::VideoCapture& cap, int cameraNumber) 
+bool PipelineCreator::findSourceImage(const std::string& inputName, cv::VideoCapture& cap, int cameraNumber, cv::Mat& firstFrame, const PipelineParameters& parameters)
 {
     if (inputName.find(".mp4") != std::string::npos || inputName.find(".avi") != std::string::npos || inputName.find(".webm") != std::string::npos) 
     {
-        cap = cv::VideoCapture("filesrc location="+inputName+" ! qtdemux ! h264parse ! nvv4l2decoder enable-max-performance=0 ! nvvidconv ! video/x-raw, format=BGRx ! videoconvert ! video/x-raw,format=BGR ! appsink max-buffers=1 drop=True", cv::CAP_GSTREAMER);
-        if (!cap.isOpened()) 
+        PipelineParameters values = parameters;
+        values["LOCATION"] = inputName;
+        std::string pipeline = PipelineTemplateCache::render(FILE_PIPELINE, values);
+        if (!openPipeline(inputName, pipeline, cap, firstFrame))
         {
             spdlog::error("Invalid input source: {}", inputName.c_str());
             return false;
@@ -67,16 +42,38 @@ bool PipelineCreator::findSourceImage(const std::string& inputName, cv::VideoCap
     {
         if (inputName == "decklink") 
         {
-            std::string pipeline = CreateDecklinkPipeline(cameraNumber);
+            std::string pipeline = CreateDecklinkPipeline(cameraNumber, parameters);
             spdlog::info("Using Decklink pipeline: {}", pipeline);
-            cap = cv::VideoCapture(pipeline, cv::CAP_GSTREAMER);
+            if (!openPipeline("decklink " + std::to_string(cameraNumber), pipeline, cap, firstFrame))
+            {
+                spdlog::error("Unable to open Decklink camera {}", cameraNumber);
+                return false;
+            }
         } 
 
         if (inputName.empty()) 
         {
-            std::string pipeline = loadDefaultPipeline();
-            cap = cv::VideoCapture(pipeline, cv::CAP_GSTREAMER);
+            std::string pipeline = loadDefaultPipeline(parameters);
+            if (!openPipeline("default", pipeline, cap, firstFrame))
+            {
+                spdlog::error("Unable to open default pipeline: {}", pipeline);
+                return false;
+            }
         }
     }
     return true;
 }
+
+bool PipelineCreator::openPipeline(const std::string& name, const std::string& pipeline, cv::VideoCapture& cap, cv::Mat& firstFrame)
+{
+    SourceLaunchResult result = SourceLauncher::launch({name, pipeline});
+    if (!result.success)
+    {
+        return false;
+    }
+
+    // The preroll frame has already been pulled from the capture, so it is handed on to the processing loop
+    firstFrame = result.firstFrame;
+    cap = std::move(result.capture);
+    return true;
+}
@@ -3,12 +3,14 @@
 
 #include <string>
 #include <opencv2/opencv.hpp>
-#include <fstream>
-#include <sstream>
 #include <spdlog/spdlog.h>
 
+#include "../pipeline_template/pipeline_template.h"
+#include "../source_launcher/source_launcher.h"
+
 #define DEFAULT_PIPELINE "gstreamer_pipeline.txt"
 #define DECKLINK_PIPELINE "decklink_pipeline.txt"
+#define FILE_PIPELINE "file_pipeline.txt"
 
 /**
  * @class PipelineCreator
@@ -17,28 +19,52 @@
 class PipelineCreator 
 {
 public:
+    /**
+     * @brief Loads and validates all pipeline templates once, so opening sources does not read them again.
+     *
+     * Missing or invalid templates are only reported as warnings; they fail when the matching input is selected.
+     */
+    static void loadTemplates();
+
     /**
      * @brief Load GStreamer pipeline configuration from a file.
+     * @param parameters Template parameters (e.g. PATTERN, WIDTH, HEIGHT, FRAMERATE) overriding the template defaults.
      * @return The GStreamer pipeline string.
+     * @throws std::runtime_error if the template cannot be loaded or is unusable.
      */
-    static std::string loadDefaultPipeline();
+    static std::string loadDefaultPipeline(const PipelineParameters& parameters = {});
 
     /**
      * @brief Creates a GStreamer pipeline string for capturing video from a Decklink device.
      * @param cameraNumber The camera number to be inserted into the pipeline configuration.
+     * @param parameters Additional template parameters (e.g. MODE, CROP_BOTTOM, MAX_BUFFERS) overriding the template defaults.
      * @return A string containing the complete GStreamer pipeline with the camera number.
+     * @throws std::runtime_error if the template cannot be loaded or is unusable.
+     * @throws std::invalid_argument if a template parameter has no value.
      */
-    static std::string CreateDecklinkPipeline(int cameraNumber);
+    static std::string CreateDecklinkPipeline(int cameraNumber, const PipelineParameters& parameters = {});
 
     /**
      * @brief Finds and opens the appropriate video source based on the input name.
      * @param inputName The name of the input source.
      * @param cap Reference to a cv::VideoCapture object to be initialized.
      * @param cameraNumber The camera number to be used for Decklink capture.
+     * @param firstFrame Receives the frame read while prerolling the source; it has to be processed before reading from cap.
+     * @param parameters Template parameters applied to the selected pipeline (e.g. MODE, CAPS, MAX_BUFFERS).
      * @return true if the input source is valid and the cv::VideoCapture object is successfully opened, false otherwise.
      */
-    static bool findSourceImage(const std::string& inputName, cv::VideoCapture& cap, int cameraNumber);
+    static bool findSourceImage(const std::string& inputName, cv::VideoCapture& cap, int cameraNumber, cv::Mat& firstFrame, const PipelineParameters& parameters = {});
 
+private:
+    /**
+     * @brief Opens a pipeline through the SourceLauncher.
+     * @param name The source name used in log messages.
+     * @param pipeline The complete GStreamer pipeline string.
+     * @param cap Reference to a cv::VideoCapture object receiving the opened capture.
+     * @param firstFrame Receives the frame read while prerolling the source.
+     * @return true if the source delivered its first frame, false otherwise.
+     */
+    static bool openPipeline(const std::string& name, const std::string& pipeline, cv::VideoCapture& cap, cv::Mat& firstFrame);
 };
 
 #endif // PIPELINECREATOR_H
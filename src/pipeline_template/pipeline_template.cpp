@@ -0,0 +1,272 @@
+#include "pipeline_template.h"
+
+#include <algorithm>
+#include <cctype>
+#include <gst/gst.h>
+
+std::map<std::string, PipelineTemplateCache::Entry> PipelineTemplateCache::entries_;
+std::mutex PipelineTemplateCache::mutex_;
+
+namespace
+{
+    std::string trim(const std::string& str)
+    {
+        const char* whitespace = " \t\r\n";
+        size_t begin = str.find_first_not_of(whitespace);
+        if (begin == std::string::npos)
+        {
+            return "";
+        }
+        size_t end = str.find_last_not_of(whitespace);
+        return str.substr(begin, end - begin + 1);
+    }
+
+    bool isValidParameterName(const std::string& name)
+    {
+        if (name.empty())
+        {
+            return false;
+        }
+        for (char c : name)
+        {
+            if (!std::isupper(static_cast<unsigned char>(c)) && !std::isdigit(static_cast<unsigned char>(c)) && c != '_')
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+PipelineTemplate PipelineTemplate::fromFile(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Unable to open pipeline template: " + path);
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return fromString(path, buffer.str());
+}
+
+PipelineTemplate PipelineTemplate::fromString(const std::string& name, const std::string& text)
+{
+    PipelineTemplate result;
+    result.name_ = name;
+
+    // Collect the pipeline lines and the default values declared in comments
+    std::string pipeline;
+    std::istringstream lines(text);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        line = trim(line);
+        if (line.empty())
+        {
+            continue;
+        }
+
+        if (line[0] == '#')
+        {
+            std::string directive = trim(line.substr(1));
+            if (directive.compare(0, 8, "default ") == 0)
+            {
+                std::string assignment = trim(directive.substr(8));
+                size_t equals = assignment.find('=');
+                std::string key = trim(assignment.substr(0, equals));
+                if (equals == std::string::npos || !isValidParameterName(key))
+                {
+                    throw std::runtime_error("Invalid default in pipeline template " + name + ": " + line);
+                }
+                result.defaults_[key] = trim(assignment.substr(equals + 1));
+            }
+            continue;
+        }
+
+        if (!pipeline.empty())
+        {
+            pipeline += ' ';
+        }
+        pipeline += line;
+    }
+
+    if (pipeline.empty())
+    {
+        throw std::runtime_error("Pipeline template is empty: " + name);
+    }
+
+    // Split the pipeline into literal text and placeholders
+    size_t pos = 0;
+    while (pos < pipeline.size())
+    {
+        size_t open = pipeline.find('$', pos);
+        if (open == std::string::npos)
+        {
+            result.segments_.push_back({false, pipeline.substr(pos)});
+            break;
+        }
+
+        size_t close = pipeline.find('$', open + 1);
+        std::string parameter = close == std::string::npos ? "" : pipeline.substr(open + 1, close - open - 1);
+        if (!isValidParameterName(parameter))
+        {
+            throw std::runtime_error("Malformed placeholder in pipeline template " + name + " at offset " + std::to_string(open));
+        }
+
+        if (open > pos)
+        {
+            result.segments_.push_back({false, pipeline.substr(pos, open - pos)});
+        }
+        result.segments_.push_back({true, parameter});
+        if (std::find(result.parameters_.begin(), result.parameters_.end(), parameter) == result.parameters_.end())
+        {
+            result.parameters_.push_back(parameter);
+        }
+        pos = close + 1;
+    }
+
+    for (const Segment& segment : result.segments_)
+    {
+        if (!segment.isParameter)
+        {
+            result.literalLength_ += segment.text.size();
+        }
+    }
+
+    // The first word of every '!' separated chunk names an element, unless it is caps ("video/x-raw"),
+    // a pad reference ("t.") or a placeholder
+    std::istringstream chunks(pipeline);
+    std::string chunk;
+    while (std::getline(chunks, chunk, '!'))
+    {
+        std::istringstream words(chunk);
+        std::string element;
+        words >> element;
+        if (element.empty() || element.find_first_of("/.$=(\"'") != std::string::npos)
+        {
+            continue;
+        }
+        if (std::find(result.elements_.begin(), result.elements_.end(), element) == result.elements_.end())
+        {
+            result.elements_.push_back(element);
+        }
+    }
+
+    return result;
+}
+
+std::string PipelineTemplate::render(const PipelineParameters& parameters) const
+{
+    std::string pipeline;
+    pipeline.reserve(literalLength_ + segments_.size() * 8);
+
+    for (const Segment& segment : segments_)
+    {
+        if (!segment.isParameter)
+        {
+            pipeline += segment.text;
+            continue;
+        }
+
+        auto value = parameters.find(segment.text);
+        if (value == parameters.end())
+        {
+            value = defaults_.find(segment.text);
+            if (value == defaults_.end())
+            {
+                throw std::invalid_argument("Missing value for $" + segment.text + "$ in pipeline template " + name_);
+            }
+        }
+        pipeline += value->second;
+    }
+
+    return pipeline;
+}
+
+void PipelineTemplateCache::loadAll(const std::vector<std::string>& paths)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const std::string& path : paths)
+    {
+        entries_.erase(path);
+        try
+        {
+            loadLocked(path);
+        }
+        catch (const std::runtime_error& e)
+        {
+            spdlog::warn("{}", e.what());
+        }
+    }
+}
+
+std::shared_ptr<const PipelineTemplate> PipelineTemplateCache::get(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = entries_.find(name);
+    Entry& entry = it != entries_.end() ? it->second : loadLocked(name);
+
+    if (!entry.missingElements.empty())
+    {
+        std::string missing;
+        for (const std::string& element : entry.missingElements)
+        {
+            missing += (missing.empty() ? "" : ", ") + element;
+        }
+        throw std::runtime_error("Pipeline template " + name + " needs unavailable GStreamer elements: " + missing);
+    }
+
+    return entry.pipelineTemplate;
+}
+
+std::string PipelineTemplateCache::render(const std::string& name, const PipelineParameters& parameters)
+{
+    return get(name)->render(parameters);
+}
+
+bool PipelineTemplateCache::isElementAvailable(const std::string& element)
+{
+    static std::once_flag initFlag;
+    std::call_once(initFlag, []()
+    {
+        if (!gst_is_initialized())
+        {
+            gst_init(nullptr, nullptr);
+        }
+    });
+
+    GstElementFactory* factory = gst_element_factory_find(element.c_str());
+    if (factory == nullptr)
+    {
+        return false;
+    }
+    gst_object_unref(factory);
+    return true;
+}
+
+PipelineTemplateCache::Entry& PipelineTemplateCache::loadLocked(const std::string& path)
+{
+    Entry entry{std::make_shared<const PipelineTemplate>(PipelineTemplate::fromFile(path)), {}};
+
+    for (const std::string& element : entry.pipelineTemplate->elements())
+    {
+        if (!isElementAvailable(element))
+        {
+            entry.missingElements.push_back(element);
+        }
+    }
+
+    if (entry.missingElements.empty())
+    {
+        spdlog::info("Loaded pipeline template {} ({} parameters, {} elements)", path, entry.pipelineTemplate->parameters().size(), entry.pipelineTemplate->elements().size());
+    }
+    else
+    {
+        spdlog::warn("Pipeline template {} references {} unavailable GStreamer element(s), first: {}", path, entry.missingElements.size(), entry.missingElements.front());
+    }
+
+    return entries_.emplace(path, std::move(entry)).first->second;
+}
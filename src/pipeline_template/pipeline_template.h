@@ -0,0 +1,154 @@
+#ifndef PIPELINETEMPLATE_H
+#define PIPELINETEMPLATE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <spdlog/spdlog.h>
+
+/**
+ * @brief Named values substituted into the `$NAME$` placeholders of a pipeline template.
+ */
+using PipelineParameters = std::map<std::string, std::string>;
+
+/**
+ * @class PipelineTemplate
+ * @brief A GStreamer pipeline description parsed once into literal text and named placeholders.
+ *
+ * Template files contain the pipeline on one or more lines, which are joined with spaces.
+ * Placeholders are written as `$NAME$` (upper case letters, digits and underscores).
+ * Lines starting with `#` are comments, except `# default NAME=value`, which gives a
+ * placeholder its default value.
+ */
+class PipelineTemplate
+{
+public:
+    /**
+     * @brief Reads and parses a template file.
+     * @param path Path of the template file, also used as the template name.
+     * @return The parsed template.
+     * @throws std::runtime_error if the file cannot be opened or contains no pipeline.
+     */
+    static PipelineTemplate fromFile(const std::string& path);
+
+    /**
+     * @brief Parses a template from its text.
+     * @param name The name of the template.
+     * @param text The template text, in the same format as a template file.
+     * @return The parsed template.
+     * @throws std::runtime_error if the text contains no pipeline or a placeholder is not closed.
+     */
+    static PipelineTemplate fromString(const std::string& name, const std::string& text);
+
+    /**
+     * @brief Builds the pipeline string by substituting every placeholder.
+     * @param parameters Values for the placeholders, overriding the template defaults. Unused entries are ignored.
+     * @return The complete GStreamer pipeline string.
+     * @throws std::invalid_argument if a placeholder has neither a value nor a default.
+     */
+    std::string render(const PipelineParameters& parameters = {}) const;
+
+    /**
+     * @brief Returns the GStreamer element factory names referenced by the template.
+     */
+    const std::vector<std::string>& elements() const { return elements_; }
+
+    /**
+     * @brief Returns the names of all placeholders in the template, without duplicates.
+     */
+    const std::vector<std::string>& parameters() const { return parameters_; }
+
+    /**
+     * @brief Returns the default placeholder values declared in the template.
+     */
+    const PipelineParameters& defaults() const { return defaults_; }
+
+    /**
+     * @brief Returns the name of the template.
+     */
+    const std::string& name() const { return name_; }
+
+private:
+    /**
+     * @brief A piece of the template: either literal pipeline text or the name of a placeholder.
+     */
+    struct Segment
+    {
+        bool isParameter;
+        std::string text;
+    };
+
+    std::string name_;
+    std::vector<Segment> segments_;
+    std::vector<std::string> parameters_;
+    std::vector<std::string> elements_;
+    PipelineParameters defaults_;
+    size_t literalLength_ = 0;
+};
+
+/**
+ * @class PipelineTemplateCache
+ * @brief Loads, validates and keeps all pipeline templates for the lifetime of the program.
+ *
+ * Each template is read from disk and checked against the GStreamer registry only once,
+ * so opening a source or reconnecting it does not touch the file system again.
+ */
+class PipelineTemplateCache
+{
+public:
+    /**
+     * @brief Loads and validates a set of template files, replacing any previously cached entry of the same name.
+     *
+     * Files that cannot be read or parsed are reported as warnings; using them later through get() throws.
+     *
+     * @param paths Paths of the template files.
+     */
+    static void loadAll(const std::vector<std::string>& paths);
+
+    /**
+     * @brief Returns a cached template, loading it on first use.
+     * @param name The template name (its file path).
+     * @return The parsed template, which stays valid even if the cache entry is reloaded.
+     * @throws std::runtime_error if the template cannot be loaded or references elements missing from the GStreamer registry.
+     */
+    static std::shared_ptr<const PipelineTemplate> get(const std::string& name);
+
+    /**
+     * @brief Renders a cached template with the given parameters.
+     * @param name The template name (its file path).
+     * @param parameters Values for the placeholders.
+     * @return The complete GStreamer pipeline string.
+     * @throws std::runtime_error if the template is unusable.
+     * @throws std::invalid_argument if a placeholder has neither a value nor a default.
+     */
+    static std::string render(const std::string& name, const PipelineParameters& parameters = {});
+
+    /**
+     * @brief Checks whether an element factory is registered with GStreamer.
+     * @param element The element factory name, e.g. "decklinkvideosrc".
+     * @return true if the element can be instantiated, false otherwise.
+     */
+    static bool isElementAvailable(const std::string& element);
+
+private:
+    /**
+     * @brief A cached template together with the elements the registry did not know.
+     */
+    struct Entry
+    {
+        std::shared_ptr<const PipelineTemplate> pipelineTemplate;
+        std::vector<std::string> missingElements;
+    };
+
+    static Entry& loadLocked(const std::string& path);
+
+    static std::map<std::string, Entry> entries_;
+    static std::mutex mutex_;
+};
+
+#endif // PIPELINETEMPLATE_H
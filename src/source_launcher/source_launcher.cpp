@@ -0,0 +1,63 @@
+#include "source_launcher.h"
+
+SourceLaunchResult SourceLauncher::launch(const SourceLaunchRequest& request)
+{
+    SourceLaunchResult result;
+    result.name = request.name;
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    try
+    {
+        if (!result.capture.open(request.pipeline, cv::CAP_GSTREAMER))
+        {
+            result.error = "Unable to open pipeline: " + request.pipeline;
+            spdlog::error("Source {}: {}", request.name, result.error);
+            return result;
+        }
+
+        auto open_time = std::chrono::steady_clock::now();
+        result.openTime = std::chrono::duration_cast<std::chrono::milliseconds>(open_time - start_time);
+
+        // Pulling one frame forces the pipeline to preroll, so the source is ready when processing starts
+        if (!result.capture.read(result.firstFrame) || result.firstFrame.empty())
+        {
+            result.error = "No frame received after opening pipeline";
+            spdlog::error("Source {}: {}", request.name, result.error);
+            result.capture.release();
+            return result;
+        }
+
+        auto first_frame_time = std::chrono::steady_clock::now();
+        result.timeToFirstFrame = std::chrono::duration_cast<std::chrono::milliseconds>(first_frame_time - start_time);
+        result.success = true;
+    }
+    catch (const cv::Exception& e)
+    {
+        result.error = e.what();
+        spdlog::error("Source {}: {}", request.name, result.error);
+        result.capture.release();
+        return result;
+    }
+
+    spdlog::info("Source {}: open time: {} ms, time to first frame: {} ms", request.name, result.openTime.count(), result.timeToFirstFrame.count());
+    return result;
+}
+
+std::vector<SourceLaunchResult> SourceLauncher::launchAll(const std::vector<SourceLaunchRequest>& requests)
+{
+    std::vector<std::future<SourceLaunchResult>> pending;
+    pending.reserve(requests.size());
+    for (const SourceLaunchRequest& request : requests)
+    {
+        pending.push_back(std::async(std::launch::async, &SourceLauncher::launch, request));
+    }
+
+    std::vector<SourceLaunchResult> results;
+    results.reserve(pending.size());
+    for (auto& future : pending)
+    {
+        results.push_back(future.get());
+    }
+    return results;
+}
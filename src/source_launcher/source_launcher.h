@@ -0,0 +1,56 @@
+#ifndef SOURCELAUNCHER_H
+#define SOURCELAUNCHER_H
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <future>
+#include <opencv2/opencv.hpp>
+#include <spdlog/spdlog.h>
+
+/**
+ * @brief Describes a source to open: a display name and its complete GStreamer pipeline.
+ */
+struct SourceLaunchRequest
+{
+    std::string name;
+    std::string pipeline;
+};
+
+/**
+ * @brief The outcome of opening a source.
+ */
+struct SourceLaunchResult
+{
+    std::string name;
+    cv::VideoCapture capture;                     ///< The opened capture, or a closed one on failure.
+    cv::Mat firstFrame;                           ///< The frame pulled while prerolling the pipeline.
+    std::chrono::milliseconds openTime{0};        ///< Time spent building the pipeline and reaching PLAYING.
+    std::chrono::milliseconds timeToFirstFrame{0}; ///< Time from the start of the launch until the first frame arrived.
+    bool success = false;
+    std::string error;
+};
+
+/**
+ * @class SourceLauncher
+ * @brief Opens and prerolls GStreamer sources, several of them concurrently.
+ */
+class SourceLauncher
+{
+public:
+    /**
+     * @brief Opens a source and waits for its first frame.
+     * @param request The source to open.
+     * @return The launch result, with timings and the first frame on success.
+     */
+    static SourceLaunchResult launch(const SourceLaunchRequest& request);
+
+    /**
+     * @brief Opens several sources in parallel, each on its own thread.
+     * @param requests The sources to open.
+     * @return One result per request, in the same order.
+     */
+    static std::vector<SourceLaunchResult> launchAll(const std::vector<SourceLaunchRequest>& requests);
+};
+
+#endif // SOURCELAUNCHER_H
@@ -2,13 +2,42 @@
 
 void VideoProcessor::processVideo(cv::VideoCapture &videoCapture, cv::VideoWriter &writer, std::atomic<bool> &stopProgram) 
 {
-    cv::Mat frame;
+    // A single level and stride keep this controller at full resolution on every frame, as before load shedding existed
+    LoadControllerConfig config;
+    config.targetFps = 25.0;
+    config.scales = {1.0};
+    config.maxFrameStride = 1;
+    config.waitKeyMs = 30;
+    LoadController loadController(config);
+    processVideo(videoCapture, writer, stopProgram, loadController);
+}
+
+void VideoProcessor::processVideo(cv::VideoCapture &videoCapture, cv::VideoWriter &writer, std::atomic<bool> &stopProgram, LoadController &loadController, const cv::Mat &firstFrame) 
+{
+    cv::Mat frame = firstFrame.clone();
+    cv::Mat workFrame;
+    bool hasPendingFrame = !frame.empty();
     while (!stopProgram.load()) 
     {
         // Measure time before reading frame
         auto start_time = std::chrono::high_resolution_clock::now();
 
-        if (!videoCapture.read(frame)) 
+        auto grab_time = start_time;
+        bool frameRead = true;
+        if (hasPendingFrame)
+        {
+            // Use the frame pulled while the source was prerolled
+            hasPendingFrame = false;
+        }
+        else
+        {
+            // grab() blocks until the source delivers a frame; that wait is idle time, not load
+            frameRead = videoCapture.grab();
+            grab_time = std::chrono::high_resolution_clock::now();
+            frameRead = frameRead && videoCapture.retrieve(frame);
+        }
+
+        if (!frameRead) 
         {
             if (videoCapture.get(cv::CAP_PROP_POS_FRAMES) >= videoCapture.get(cv::CAP_PROP_FRAME_COUNT)) 
             {
@@ -34,11 +63,23 @@ void VideoProcessor::processVideo(cv::VideoCapture &videoCapture, cv::VideoWrite
             break;
         } 
 
-        // Process and display image
-        processAndDisplayImage(frame, writer);
+        // Process the frame unless the load controller skips it, at the resolution it chooses
+        auto process_start_time = std::chrono::high_resolution_clock::now();
+        auto process_time = process_start_time;
+        if (loadController.shouldProcess())
+        {
+            FrameTransform transform = loadController.prepareFrame(frame, workFrame);
+            processImage(workFrame, transform);
+
+            process_time = std::chrono::high_resolution_clock::now();
+            loadController.recordProcessingTime(std::chrono::duration<double, std::milli>(process_time - process_start_time).count(), frame.size());
+        }
+
+        // Display and record the full frame, whether or not it was processed
+        displayImage(frame, writer);
 
-        // Measure time after processing frame
-        auto process_time = std::chrono::high_resolution_clock::now();
+        // Measure time after displaying frame
+        auto display_time = std::chrono::high_resolution_clock::now();
 
         if(stopProgram.load())
         {
@@ -47,13 +88,19 @@ void VideoProcessor::processVideo(cv::VideoCapture &videoCapture, cv::VideoWrite
 
         // Calculate elapsed times
         auto read_duration = std::chrono::duration_cast<std::chrono::milliseconds>(read_time - start_time);
-        auto process_duration = std::chrono::duration_cast<std::chrono::milliseconds>(process_time - read_time);
-        auto total_duration = std::chrono::duration_cast<std::chrono::milliseconds>(process_time - start_time);
+        auto process_duration = std::chrono::duration_cast<std::chrono::milliseconds>(process_time - process_start_time);
+        auto total_duration = std::chrono::duration_cast<std::chrono::milliseconds>(display_time - start_time);
 
         // Print timings
-        spdlog::info("Read time: {} ms, Process time: {} ms, Total time: {} ms", read_duration.count(), process_duration.count(), total_duration.count());
+        spdlog::info("Read time: {} ms, Process time: {} ms, Total time: {} ms, Load level: {}", read_duration.count(), process_duration.count(), total_duration.count(), loadController.level());
+
+        int key = cv::waitKey(loadController.waitKeyMs());
 
-        if (cv::waitKey(30) >= 0) 
+        // Everything after the frame arrived, except the processing step, is overhead the load controller cannot shed
+        auto pass_end_time = std::chrono::high_resolution_clock::now();
+        loadController.recordOverheadTime(std::chrono::duration<double, std::milli>((pass_end_time - grab_time) - (process_time - process_start_time)).count());
+
+        if (key >= 0) 
         {
             break;
         }
@@ -61,6 +108,20 @@ void VideoProcessor::processVideo(cv::VideoCapture &videoCapture, cv::VideoWrite
 }
 
 void VideoProcessor::processAndDisplayImage(cv::Mat &image, cv::VideoWriter &writer) 
+{
+    processImage(image, FrameTransform{cv::Rect(0, 0, image.cols, image.rows), 1.0});
+    displayImage(image, writer);
+}
+
+void VideoProcessor::processImage(cv::Mat &image, const FrameTransform &transform) 
+{
+    // Image analytics go here; the load controller may hand over a downscaled or cropped image,
+    // results map back onto the full frame as transform.roi.tl() + point / transform.scale
+    (void)image;
+    (void)transform;
+}
+
+void VideoProcessor::displayImage(const cv::Mat &image, cv::VideoWriter &writer) 
 {
     if (writer.isOpened()) 
     {
@@ -7,6 +7,7 @@
 #include <chrono>
 
 #include "../global_image/global_image.h"
+#include "../load_controller/load_controller.h"
 
 /**
  * @class VideoProcessor
@@ -15,13 +16,23 @@
 class VideoProcessor {
 public:
     /**
-     * @brief Processes video frames from a cv::VideoCapture object.
+     * @brief Processes video frames from a cv::VideoCapture object, every frame at full resolution.
      * @param videoCapture Reference to a cv::VideoCapture object.
      * @param writer Reference to a cv::VideoWriter object.
      * @param stopProgram Reference to an atomic boolean flag to stop the video processing loop.
      */
     static void processVideo(cv::VideoCapture &videoCapture, cv::VideoWriter &writer, std::atomic<bool> &stopProgram);
 
+    /**
+     * @brief Processes video frames, shedding load through a LoadController to hold its target frame rate.
+     * @param videoCapture Reference to a cv::VideoCapture object.
+     * @param writer Reference to a cv::VideoWriter object.
+     * @param stopProgram Reference to an atomic boolean flag to stop the video processing loop.
+     * @param loadController Reference to the controller deciding the resolution and which frames are processed.
+     * @param firstFrame Frame already pulled from the capture (e.g. while prerolling), processed before reading; may be empty.
+     */
+    static void processVideo(cv::VideoCapture &videoCapture, cv::VideoWriter &writer, std::atomic<bool> &stopProgram, LoadController &loadController, const cv::Mat &firstFrame = cv::Mat());
+
     /**
      * @brief Processes and displays a single image frame.
      * @param image Reference to the image frame to be processed.
@@ -29,6 +40,20 @@ public:
      */
     static void processAndDisplayImage(cv::Mat &image, cv::VideoWriter &writer);
 
+    /**
+     * @brief Runs the image analytics on a frame.
+     * @param image Reference to the image to analyze, possibly downscaled or cropped by the load controller.
+     * @param transform The region and scale mapping the image back onto the captured frame.
+     */
+    static void processImage(cv::Mat &image, const FrameTransform &transform);
+
+    /**
+     * @brief Writes a frame to the video writer, if open, and displays it.
+     * @param image The full resolution frame.
+     * @param writer Reference to a cv::VideoWriter object.
+     */
+    static void displayImage(const cv::Mat &image, cv::VideoWriter &writer);
+
     /**
      * @brief Prints detailed information about an image, including its resolution, format, pixel size, and memory size.
      *